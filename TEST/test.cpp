@@ -84,6 +84,74 @@ public:
     }
 };
 
+class RecordingSink : public RELAY_SINK
+{
+public:
+
+    std::vector<std::string> sentences;
+
+    void Write(std::string_view sentence) noexcept override
+    {
+        sentences.emplace_back(sentence);
+    }
+};
+
+static void test_relay(void) noexcept
+{
+    RecordingSink everything;
+    RecordingSink navigation;
+
+    RELAY relay;
+
+    auto const everything_bit{ relay.AddSink(&everything) };
+    auto const navigation_bit{ relay.AddSink(&navigation) };
+
+    relay.DefaultRule.Sinks = 1 << everything_bit;
+
+    relay.AddRule(RELAY_RULE(STRING_VIEW("GP"), STRING_VIEW("GGA"), RELAY_ACTION::Forward, STRING_VIEW("GN"), (1 << everything_bit) | (1 << navigation_bit)));
+    relay.AddRule(RELAY_RULE(STRING_VIEW(""), STRING_VIEW("GSV"), RELAY_ACTION::Drop));
+
+    if (relay.AddRule(RELAY_RULE(STRING_VIEW(""), STRING_VIEW(""), RELAY_ACTION::Forward, STRING_VIEW("GPS"))) == true)
+    {
+        printf("Failed relay test, accepted a three character talker\n");
+    }
+
+    char buffer[] = "$GPGGA,103050,3912.073,N,07646.887,W,1,08,1.8,2.5,M,-34.0,M,,*72\r\n"
+                    "$GPGSV,3,1,11,03,03,111,00,04,15,270,00,06,01,010,00,13,06,292,00*74\r\n"
+                    "$GPXTE,A,A,0.67,L,N*6F\r\n"
+                    "$GPXTE,A,A,0.67,L,N*6E\r\n"
+                    "$PGRMZ,93,f,3*21\r\n"
+                    "$GPGLL,5133.81,N,00";
+
+    auto const buffer_length{ std::size(buffer) - 1 };
+    auto const number_of_bytes_used{ relay.Relay(buffer, buffer_length) };
+
+    if (std::string_view(buffer + number_of_bytes_used, buffer_length - number_of_bytes_used).compare(STRING_VIEW("$GPGLL,5133.81,N,00")) != 0)
+    {
+        printf("Failed relay test, partial sentence was consumed\n");
+    }
+
+    if (everything.sentences.size() != 3 || navigation.sentences.size() != 1)
+    {
+        printf("Failed relay test, sinks received %d and %d sentences\n", static_cast<int>(everything.sentences.size()), static_cast<int>(navigation.sentences.size()));
+        return;
+    }
+
+    if (navigation.sentences[0].compare(STRING_VIEW("$GNGGA,103050,3912.073,N,07646.887,W,1,08,1.8,2.5,M,-34.0,M,,*6C\r\n")) != 0)
+    {
+        printf("Failed relay test, talker rewrite produced \"%s\"\n", navigation.sentences[0].c_str());
+    }
+
+    SENTENCE sentence;
+
+    sentence = navigation.sentences[0];
+
+    if (sentence.IsChecksumBad(sentence.GetNumberOfDataFields() + 1) != NMEA0183_BOOLEAN::False)
+    {
+        printf("Failed relay test, patched checksum is bad\n");
+    }
+}
+
 int main()
 {
    std::vector<NMEA_TEST> test_sentences;
@@ -139,5 +207,7 @@ int main()
 
    std::for_each( test_sentences.cbegin(), test_sentences.cend(), testerinator );
 
+   test_relay();
+
    return( EXIT_SUCCESS );
 }